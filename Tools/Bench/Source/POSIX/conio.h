@@ -0,0 +1,15 @@
+/*****************************************************************************
+ * Win32 emulation for building CP/M tools PK8000 on Linux (benchmarks).     *
+ * Copyright (C) 2017 Andrey Hlus                                            *
+ *****************************************************************************/
+#ifndef _W32_CONIO_H_
+#define _W32_CONIO_H_
+
+// консоль без клавиатуры: ответы на запросы утилит берутся из строки
+// w32_Keys (по символу на каждый getch()), по ее окончании - 'n'
+extern const char *w32_Keys;
+
+int getch(void);
+int kbhit(void);
+
+#endif
@@ -0,0 +1,2 @@
+// имена заголовков в исходниках - без учета регистра (WATCOM)
+#include "../../../PlugIn/Source/CPMPLG.H"
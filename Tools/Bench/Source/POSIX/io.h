@@ -0,0 +1,26 @@
+/*****************************************************************************
+ * Win32 emulation for building CP/M tools PK8000 on Linux (benchmarks).     *
+ * Copyright (C) 2017 Andrey Hlus                                            *
+ *****************************************************************************/
+#ifndef _W32_IO_H_
+#define _W32_IO_H_
+
+#define _A_NORMAL   0x00
+#define _A_RDONLY   0x01
+#define _A_SUBDIR   0x10
+
+struct _finddata_t {
+    unsigned        attrib;
+    long            time_create;
+    long            time_access;
+    long            time_write;
+    unsigned long   size;
+    char            name[260];
+};
+
+// поиск по маске - через glob(), маска в стиле POSIX ("/tmp/dir/*.BIN")
+long _findfirst(const char *mask, struct _finddata_t *info);
+int  _findnext(long handle, struct _finddata_t *info);
+int  _findclose(long handle);
+
+#endif
@@ -0,0 +1,173 @@
+/*****************************************************************************
+ * Win32 emulation for building CP/M tools PK8000 on Linux (benchmarks).     *
+ * Copyright (C) 2017 Andrey Hlus                                            *
+ *****************************************************************************/
+#ifndef _W32_WINDOWS_H_
+#define _W32_WINDOWS_H_
+
+// только то подмножество Win32 API, которое используют CPMHDD.C, LOG.C,
+// C8000W.C, F8000W.C и BLKIO.C; файлы образов и потоки - через POSIX
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+
+typedef int                 BOOL;
+typedef unsigned char       BYTE;
+typedef unsigned short      WORD;
+typedef unsigned int        DWORD;
+typedef unsigned int        UINT;
+typedef unsigned int        UINT32;
+typedef int                 LONG;
+typedef long long           LONGLONG;
+typedef unsigned long long  ULONGLONG;
+typedef void               *HANDLE;
+typedef void               *HMODULE;
+typedef void               *HINSTANCE;
+typedef void               *HWND;
+typedef void               *LPVOID;
+typedef DWORD              *LPDWORD;
+typedef const char         *LPCSTR;
+typedef char               *LPSTR;
+typedef long                LPARAM;
+typedef unsigned long       WPARAM;
+
+typedef union {
+    struct {
+        DWORD   LowPart;
+        LONG    HighPart;
+    };
+    LONGLONG    QuadPart;
+} LARGE_INTEGER;
+
+typedef struct {
+    DWORD   dwLowDateTime;
+    DWORD   dwHighDateTime;
+} FILETIME;
+
+typedef struct {
+    WORD    wYear, wMonth, wDayOfWeek, wDay;
+    WORD    wHour, wMinute, wSecond, wMilliseconds;
+} SYSTEMTIME;
+
+typedef struct {
+    DWORD       dwFileAttributes;
+    FILETIME    ftCreationTime;
+    FILETIME    ftLastAccessTime;
+    FILETIME    ftLastWriteTime;
+    DWORD       nFileSizeHigh;
+    DWORD       nFileSizeLow;
+    DWORD       dwReserved0;
+    DWORD       dwReserved1;
+    char        cFileName[260];
+    char        cAlternateFileName[14];
+} WIN32_FIND_DATA;
+
+// критическая секция - рекурсивный мьютекс, как и в Win32
+typedef struct {
+    pthread_mutex_t mutex;
+} CRITICAL_SECTION;
+
+#define TRUE                    1
+#define FALSE                   0
+#define MAX_PATH                260
+#define _MAX_PATH               260
+#define _MAX_DRIVE              3
+#define _MAX_DIR                256
+#define _MAX_FNAME              256
+#define _MAX_EXT                256
+
+#define WINAPI
+#define APIENTRY
+#define CALLBACK
+#define __stdcall
+#define __declspec(x)
+
+#define INVALID_HANDLE_VALUE        ((HANDLE) (long) -1)
+#define INVALID_SET_FILE_POINTER    ((DWORD) -1)
+#define INVALID_FILE_SIZE           ((DWORD) 0xFFFFFFFF)
+#define INVALID_FILE_ATTRIBUTES     ((DWORD) -1)
+#define NO_ERROR                    0
+
+#define GENERIC_READ                0x80000000
+#define GENERIC_WRITE               0x40000000
+#define FILE_SHARE_READ             0x00000001
+#define FILE_SHARE_WRITE            0x00000002
+#define CREATE_NEW                  1
+#define CREATE_ALWAYS               2
+#define OPEN_EXISTING               3
+#define OPEN_ALWAYS                 4
+#define FILE_BEGIN                  0
+#define FILE_CURRENT                1
+#define FILE_END                    2
+
+#define FILE_ATTRIBUTE_READONLY     0x00000001
+#define FILE_ATTRIBUTE_HIDDEN       0x00000002
+#define FILE_ATTRIBUTE_SYSTEM       0x00000004
+#define FILE_ATTRIBUTE_DIRECTORY    0x00000010
+#define FILE_ATTRIBUTE_ARCHIVE      0x00000020
+#define FILE_ATTRIBUTE_NORMAL       0x00000080
+
+// printf из glibc не знает I64 (см. Common\PORT.H)
+#define PRI64                       "ll"
+
+#define INFINITE                    0xFFFFFFFF
+#define WAIT_OBJECT_0               0
+#define WAIT_TIMEOUT                258
+#define WAIT_FAILED                 ((DWORD) 0xFFFFFFFF)
+#define THREAD_PRIORITY_LOWEST          (-2)
+#define THREAD_PRIORITY_BELOW_NORMAL    (-1)
+#define THREAD_PRIORITY_NORMAL          0
+
+typedef DWORD (WINAPI *LPTHREAD_START_ROUTINE)(LPVOID);
+
+
+// файлы
+HANDLE  CreateFile(LPCSTR name, DWORD access, DWORD share, LPVOID sa, DWORD disp, DWORD attr, HANDLE tmpl);
+BOOL    CloseHandle(HANDLE h);
+BOOL    ReadFile(HANDLE h, LPVOID buff, DWORD n, LPDWORD nDone, LPVOID ovl);
+BOOL    WriteFile(HANDLE h, const void *buff, DWORD n, LPDWORD nDone, LPVOID ovl);
+DWORD   SetFilePointer(HANDLE h, LONG lo, LONG *hi, DWORD method);
+BOOL    SetEndOfFile(HANDLE h);
+BOOL    FlushFileBuffers(HANDLE h);
+DWORD   GetFileSize(HANDLE h, LPDWORD hi);
+BOOL    GetFileTime(HANDLE h, FILETIME *create, FILETIME *access, FILETIME *write);
+DWORD   GetFileAttributes(LPCSTR name);
+BOOL    SetFileAttributes(LPCSTR name, DWORD attr);
+BOOL    DeleteFile(LPCSTR name);
+BOOL    DeviceIoControl(HANDLE h, DWORD code, LPVOID in, DWORD nIn, LPVOID out, DWORD nOut, LPDWORD nRet, LPVOID ovl);
+DWORD   GetLastError(void);
+
+// время
+void    GetLocalTime(SYSTEMTIME *t);
+DWORD   GetTickCount(void);
+BOOL    QueryPerformanceCounter(LARGE_INTEGER *cnt);
+BOOL    QueryPerformanceFrequency(LARGE_INTEGER *freq);
+void    Sleep(DWORD ms);
+
+// потоки и синхронизация
+HANDLE  CreateThread(LPVOID sa, size_t stack, LPTHREAD_START_ROUTINE proc, LPVOID param, DWORD flags, LPDWORD id);
+BOOL    SetThreadPriority(HANDLE h, int priority);
+DWORD   WaitForSingleObject(HANDLE h, DWORD ms);
+DWORD   WaitForMultipleObjects(DWORD n, const HANDLE *h, BOOL bWaitAll, DWORD ms);
+void    InitializeCriticalSection(CRITICAL_SECTION *cs);
+void    DeleteCriticalSection(CRITICAL_SECTION *cs);
+void    EnterCriticalSection(CRITICAL_SECTION *cs);
+void    LeaveCriticalSection(CRITICAL_SECTION *cs);
+
+#define InterlockedIncrement(p)         __sync_add_and_fetch((p), 1)
+#define InterlockedDecrement(p)         __sync_sub_and_fetch((p), 1)
+#define InterlockedExchangeAdd(p, v)    __sync_fetch_and_add((p), (v))
+#define InterlockedExchange(p, v)       __sync_lock_test_and_set((p), (v))
+
+// runtime библиотеки WATCOM/MSVC
+void    _splitpath(const char *path, char *drive, char *dir, char *fname, char *ext);
+char   *strupr(char *s);
+size_t  strlcpy(char *dst, const char *src, size_t size);
+#define stricmp     strcasecmp
+#define strnicmp    strncasecmp
+
+#include "winioctl.h"
+
+#endif
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * Win32 emulation for building CP/M tools PK8000 on Linux (benchmarks).     *
+ * Copyright (C) 2017 Andrey Hlus                                            *
+ *****************************************************************************/
+#ifndef _W32_WINIOCTL_H_
+#define _W32_WINIOCTL_H_
+
+// физических дисков нет: запросы геометрии и свойств всегда неудачны,
+// поддерживаются только разреженные файлы образов
+#define IOCTL_DISK_GET_DRIVE_GEOMETRY   0x00070000
+#define IOCTL_STORAGE_QUERY_PROPERTY    0x002D1400
+#define FSCTL_SET_SPARSE                0x000900C4
+#define FSCTL_SET_ZERO_DATA             0x000980C8
+
+typedef enum {
+    Unknown         = 0,
+    RemovableMedia  = 11,
+    FixedMedia      = 12
+} MEDIA_TYPE;
+
+typedef struct {
+    LARGE_INTEGER   Cylinders;
+    MEDIA_TYPE      MediaType;
+    DWORD           TracksPerCylinder;
+    DWORD           SectorsPerTrack;
+    DWORD           BytesPerSector;
+} DISK_GEOMETRY;
+
+typedef enum {
+    StorageDeviceProperty = 0
+} STORAGE_PROPERTY_ID;
+
+typedef enum {
+    PropertyStandardQuery = 0
+} STORAGE_QUERY_TYPE;
+
+typedef struct {
+    STORAGE_PROPERTY_ID PropertyId;
+    STORAGE_QUERY_TYPE  QueryType;
+    BYTE                AdditionalParameters[1];
+} STORAGE_PROPERTY_QUERY;
+
+typedef struct {
+    DWORD   Version;
+    DWORD   Size;
+} STORAGE_DESCRIPTOR_HEADER;
+
+typedef struct {
+    DWORD   Version;
+    DWORD   Size;
+    BYTE    DeviceType;
+    BYTE    DeviceTypeModifier;
+    BYTE    RemovableMedia;
+    BYTE    CommandQueueing;
+    DWORD   VendorIdOffset;
+    DWORD   ProductIdOffset;
+    DWORD   ProductRevisionOffset;
+    DWORD   SerialNumberOffset;
+} STORAGE_DEVICE_DESCRIPTOR;
+
+#endif